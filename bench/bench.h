@@ -0,0 +1,83 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace eb::bench {
+
+struct Result {
+    std::string name;
+    double ns_per_op = 0.0;
+    double bytes_per_op = 0.0;
+    uint64_t iterations = 0;
+};
+
+class Context {
+public:
+    explicit Context(std::string_view filter, double min_seconds = 0.25);
+
+    bool Enabled(std::string_view name) const;
+
+    // Runs fn in batches until min_seconds have elapsed and records the mean time per call.
+    template <typename Fn>
+    void Run(std::string_view name, Fn&& fn, double bytes_per_op = 0.0) {
+        if (!Enabled(name)) {
+            return;
+        }
+        using Clock = std::chrono::steady_clock;
+        fn();
+        uint64_t iterations = 0;
+        uint64_t batch = 1;
+        double elapsed = 0.0;
+        while (elapsed < min_seconds_) {
+            auto start = Clock::now();
+            for (uint64_t i = 0; i < batch; ++i) {
+                fn();
+            }
+            elapsed += std::chrono::duration<double>(Clock::now() - start).count();
+            iterations += batch;
+            if (batch < (uint64_t{1} << 30)) {
+                batch *= 2;
+            }
+        }
+        Record(name, elapsed * 1e9 / static_cast<double>(iterations), bytes_per_op, iterations);
+    }
+
+    // Records a derived metric that is not a per-call timing (hit rates, byte counts, ...).
+    void Metric(std::string_view name, double value, std::string_view unit);
+
+    const std::vector<Result>& results() const { return results_; }
+
+private:
+    void Record(std::string_view name, double ns_per_op, double bytes_per_op, uint64_t iterations);
+
+    std::string filter_;
+    double min_seconds_;
+    std::vector<Result> results_;
+};
+
+using GroupFn = void (*)(Context& ctx);
+
+struct Registration {
+    Registration(const char* group, GroupFn fn);
+};
+
+template <typename T>
+inline void DoNotOptimize(const T& value) {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "g"(&value) : "memory");
+#else
+    static volatile const void* sink;
+    sink = &value;
+#endif
+}
+
+} // namespace eb::bench
+
+#define EB_BENCH_GROUP(group)                                                   \
+    static void group##_bench(::eb::bench::Context& ctx);                       \
+    static ::eb::bench::Registration group##_registration(#group, group##_bench); \
+    static void group##_bench(::eb::bench::Context& ctx)
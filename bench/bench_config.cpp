@@ -0,0 +1,184 @@
+#include "bench.h"
+
+#include "config_json.h"
+
+#include <cctype>
+#include <cstdlib>
+#include <string>
+
+namespace {
+
+// The per-key extractors LoadConfig used before the tokenizer, kept here as the comparison baseline.
+namespace legacy {
+
+bool FindValueStart(const std::string& json, const char* key, size_t* pos_out) {
+    std::string needle = "\"";
+    needle += key;
+    needle += "\"";
+    size_t pos = json.find(needle);
+    if (pos == std::string::npos) {
+        return false;
+    }
+    pos = json.find(':', pos + needle.size());
+    if (pos == std::string::npos) {
+        return false;
+    }
+    pos += 1;
+    while (pos < json.size() && std::isspace(static_cast<unsigned char>(json[pos]))) {
+        ++pos;
+    }
+    if (pos >= json.size()) {
+        return false;
+    }
+    *pos_out = pos;
+    return true;
+}
+
+bool ExtractString(const std::string& json, const char* key, std::string* out) {
+    size_t pos = 0;
+    if (!FindValueStart(json, key, &pos)) {
+        return false;
+    }
+    if (json[pos] != '"') {
+        return false;
+    }
+    std::string value;
+    for (size_t i = pos + 1; i < json.size(); ++i) {
+        char c = json[i];
+        if (c == '\\' && i + 1 < json.size()) {
+            value.push_back(json[i + 1]);
+            ++i;
+            continue;
+        }
+        if (c == '"') {
+            *out = value;
+            return true;
+        }
+        value.push_back(c);
+    }
+    return false;
+}
+
+bool ExtractDouble(const std::string& json, const char* key, double* out) {
+    size_t pos = 0;
+    if (!FindValueStart(json, key, &pos)) {
+        return false;
+    }
+    char* end = nullptr;
+    double value = std::strtod(json.c_str() + pos, &end);
+    if (end == json.c_str() + pos) {
+        return false;
+    }
+    *out = value;
+    return true;
+}
+
+bool ExtractBool(const std::string& json, const char* key, bool* out) {
+    size_t pos = 0;
+    if (!FindValueStart(json, key, &pos)) {
+        return false;
+    }
+    if (json.compare(pos, 4, "true") == 0) {
+        *out = true;
+        return true;
+    }
+    if (json.compare(pos, 5, "false") == 0) {
+        *out = false;
+        return true;
+    }
+    if (json[pos] == '1' || json[pos] == '0') {
+        *out = (json[pos] == '1');
+        return true;
+    }
+    return false;
+}
+
+std::wstring Widen(const std::string& s) {
+    return std::wstring(s.begin(), s.end());
+}
+
+void Load(const std::string& json, eb::Config* cfg) {
+    double value = 0.0;
+    bool flag = false;
+    std::string str;
+    if (ExtractString(json, "language", &str)) cfg->language = eb::ParseLanguage(str);
+    if (ExtractBool(json, "autostart", &flag)) cfg->autostart = flag;
+    if (ExtractDouble(json, "work_interval_minutes", &value)) cfg->work_interval_minutes = value;
+    if (ExtractDouble(json, "rest_seconds", &value)) cfg->rest_seconds = value;
+    if (ExtractDouble(json, "fade_ms", &value)) cfg->fade_ms = value;
+    if (ExtractDouble(json, "fps", &value)) cfg->fps = value;
+    if (ExtractString(json, "message", &str)) cfg->message = Widen(str);
+    if (ExtractString(json, "bg_color", &str)) eb::ParseHexColor(str, &cfg->bg_color);
+    if (ExtractString(json, "text_color", &str)) eb::ParseHexColor(str, &cfg->text_color);
+    if (ExtractString(json, "visual_mode", &str)) cfg->visual_mode = eb::VisualMode::Image;
+    if (ExtractString(json, "image_path", &str)) cfg->image_path = Widen(str);
+    if (ExtractString(json, "image_mode", &str)) cfg->image_mode = eb::ImageMode::Fit;
+    if (ExtractDouble(json, "image_opacity", &value)) cfg->image_opacity = static_cast<float>(value);
+    if (ExtractDouble(json, "breath_cycle_ms", &value)) cfg->breath_cycle_ms = value;
+    if (ExtractDouble(json, "breath_min_radius", &value)) cfg->breath_min_radius = static_cast<float>(value);
+    if (ExtractDouble(json, "breath_max_radius", &value)) cfg->breath_max_radius = static_cast<float>(value);
+    if (ExtractDouble(json, "breath_opacity", &value)) cfg->breath_opacity = static_cast<float>(value);
+}
+
+} // namespace legacy
+
+const char* kShippedConfig = R"({
+  "language": "en",
+  "autostart": false,
+  "work_interval_minutes": 20,
+  "rest_seconds": 20,
+  "fade_ms": 600,
+  "fps": 20,
+  "bg_color": "#111111",
+  "text_color": "#CFCFCF",
+  "message": "Look far and blink",
+
+  "visual_mode": "image",
+  "image_path": "assets\\bg.png",
+  "image_mode": "fit",
+  "image_opacity": 0.35,
+
+  "breath_cycle_ms": 9000,
+  "breath_min_radius": 80,
+  "breath_max_radius": 140,
+  "breath_opacity": 0.35
+}
+)";
+
+// Pads the shipped config with unknown keys (as a management script might add) so that the
+// known keys sit at the end of a document of roughly target_bytes.
+std::string GenerateConfig(size_t target_bytes) {
+    std::string json = "{\n";
+    int n = 0;
+    while (json.size() < target_bytes) {
+        json += "  \"x_note_" + std::to_string(n++) + "\": \"padding text with \\\"quotes\\\" and \\u00e9\",\n";
+        json += "  \"x_list_" + std::to_string(n++) + "\": [1, 2.5, {\"nested\": true}],\n";
+    }
+    std::string shipped = kShippedConfig;
+    json += shipped.substr(shipped.find('{') + 1);
+    return json;
+}
+
+void BenchDocument(eb::bench::Context& ctx, const std::string& label, const std::string& json) {
+    double bytes = static_cast<double>(json.size());
+    ctx.Run("config.parse.legacy_extract/" + label, [&] {
+        eb::Config cfg;
+        legacy::Load(json, &cfg);
+        eb::bench::DoNotOptimize(cfg);
+    }, bytes);
+    ctx.Run("config.parse.tokenizer/" + label, [&] {
+        eb::Config cfg;
+        eb::JsonError error;
+        bool ok = eb::ParseConfigJson(json, &cfg, &error);
+        eb::bench::DoNotOptimize(ok);
+        eb::bench::DoNotOptimize(cfg);
+    }, bytes);
+}
+
+} // namespace
+
+EB_BENCH_GROUP(config_parse) {
+    BenchDocument(ctx, "shipped", kShippedConfig);
+    BenchDocument(ctx, "64KiB", GenerateConfig(64 * 1024));
+    BenchDocument(ctx, "1MiB", GenerateConfig(1024 * 1024));
+}
@@ -0,0 +1,69 @@
+#include "bench.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+namespace eb::bench {
+namespace {
+
+struct Group {
+    const char* name;
+    GroupFn fn;
+};
+
+std::vector<Group>& Groups() {
+    static std::vector<Group> groups;
+    return groups;
+}
+
+} // namespace
+
+Registration::Registration(const char* group, GroupFn fn) {
+    Groups().push_back({group, fn});
+}
+
+Context::Context(std::string_view filter, double min_seconds) : filter_(filter), min_seconds_(min_seconds) {}
+
+bool Context::Enabled(std::string_view name) const {
+    return filter_.empty() || name.find(filter_) != std::string_view::npos;
+}
+
+void Context::Record(std::string_view name, double ns_per_op, double bytes_per_op, uint64_t iterations) {
+    results_.push_back({std::string(name), ns_per_op, bytes_per_op, iterations});
+    if (bytes_per_op > 0.0) {
+        std::printf("%-48s %14.1f ns/op %10.2f GB/s\n", results_.back().name.c_str(), ns_per_op, bytes_per_op / ns_per_op);
+    } else {
+        std::printf("%-48s %14.1f ns/op\n", results_.back().name.c_str(), ns_per_op);
+    }
+}
+
+void Context::Metric(std::string_view name, double value, std::string_view unit) {
+    if (!Enabled(name)) {
+        return;
+    }
+    std::printf("%-48s %14.3f %.*s\n", std::string(name).c_str(), value, static_cast<int>(unit.size()), unit.data());
+}
+
+} // namespace eb::bench
+
+int main(int argc, char** argv) {
+    const char* filter = "";
+    double min_seconds = 0.25;
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--filter") == 0 && i + 1 < argc) {
+            filter = argv[++i];
+        } else if (std::strcmp(argv[i], "--min-time") == 0 && i + 1 < argc) {
+            min_seconds = std::atof(argv[++i]);
+        } else {
+            std::fprintf(stderr, "usage: %s [--filter substring] [--min-time seconds]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    eb::bench::Context ctx(filter, min_seconds);
+    for (const auto& group : eb::bench::Groups()) {
+        group.fn(ctx);
+    }
+    return 0;
+}
@@ -0,0 +1,60 @@
+#include "bench.h"
+#include "bench_util.h"
+
+#include "config.h"
+#include "overlay_frame.h"
+#include "soft_renderer.h"
+
+#include <memory>
+#include <string>
+
+namespace {
+
+struct Resolution {
+    const char* label;
+    int width;
+    int height;
+};
+
+constexpr Resolution kResolutions[] = {
+    {"1080p", 1920, 1080},
+    {"4K", 3840, 2160},
+    {"8K", 7680, 4320},
+};
+
+struct ModeCase {
+    const char* label;
+    eb::VisualMode mode;
+};
+
+constexpr ModeCase kModes[] = {
+    {"breathing", eb::VisualMode::Breathing},
+    {"image", eb::VisualMode::Image},
+    {"image+breathing", eb::VisualMode::ImageBreathing},
+};
+
+} // namespace
+
+EB_BENCH_GROUP(render_software) {
+    auto image = std::make_shared<const eb::Bitmap>(eb::bench::MakeTestImage());
+    for (const Resolution& res : kResolutions) {
+        for (const ModeCase& mode : kModes) {
+            std::string name = std::string("render.software_frame/") + res.label + "/" + mode.label;
+            if (!ctx.Enabled(name)) {
+                continue;
+            }
+            eb::Config cfg;
+            cfg.visual_mode = mode.mode;
+            eb::SoftwareRenderBackend backend(res.width, res.height);
+            backend.SetImage(image);
+            eb::OverlayFrameInput input;
+            input.rest_remaining = 20.0;
+            double bytes = static_cast<double>(backend.framebuffer().ByteSize());
+            ctx.Run(name, [&] {
+                input.total_elapsed += 0.05;
+                eb::RenderOverlayFrame(&backend, cfg, input);
+                eb::bench::DoNotOptimize(backend.framebuffer().pixels.data());
+            }, bytes);
+        }
+    }
+}
@@ -0,0 +1,28 @@
+#pragma once
+
+#include "bitmap.h"
+
+#include <cstdint>
+
+namespace eb::bench {
+
+// Deterministic opaque test photo: smooth gradients plus high-frequency detail, so filters
+// and blends have something to chew on. Same size as assets/bg.png by default.
+inline Bitmap MakeTestImage(int width = 1980, int height = 1080, uint32_t seed = 1) {
+    Bitmap image(width, height);
+    uint32_t state = seed * 2654435761u + 1;
+    for (int y = 0; y < height; ++y) {
+        uint32_t* row = image.Row(y);
+        for (int x = 0; x < width; ++x) {
+            state = state * 1664525u + 1013904223u;
+            uint32_t noise = (state >> 24) & 0x1F;
+            uint32_t r = static_cast<uint32_t>(x * 255 / (width > 1 ? width - 1 : 1));
+            uint32_t g = static_cast<uint32_t>(y * 255 / (height > 1 ? height - 1 : 1));
+            uint32_t b = ((x / 16 + y / 16) & 1) ? 200 : 40;
+            row[x] = PackBgra(b ^ noise, g, r ^ (noise >> 1), 255);
+        }
+    }
+    return image;
+}
+
+} // namespace eb::bench
@@ -0,0 +1,75 @@
+#pragma once
+
+#include "config.h"
+
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+namespace eb {
+
+// Premultiplied BGRA, one uint32_t per pixel (0xAARRGGBB on little-endian), rows packed
+// without padding. Matches GUID_WICPixelFormat32bppPBGRA.
+struct Bitmap {
+    int width = 0;
+    int height = 0;
+    std::vector<uint32_t> pixels;
+
+    Bitmap() = default;
+    Bitmap(int w, int h) : width(w), height(h), pixels(static_cast<size_t>(w) * static_cast<size_t>(h), 0) {}
+
+    uint32_t* Row(int y) { return pixels.data() + static_cast<size_t>(y) * static_cast<size_t>(width); }
+    const uint32_t* Row(int y) const { return pixels.data() + static_cast<size_t>(y) * static_cast<size_t>(width); }
+    size_t ByteSize() const { return pixels.size() * sizeof(uint32_t); }
+};
+
+inline uint32_t PackBgra(uint32_t b, uint32_t g, uint32_t r, uint32_t a) {
+    return b | (g << 8) | (r << 16) | (a << 24);
+}
+
+inline uint32_t ToUnorm8(float v) {
+    if (v <= 0.0f) {
+        return 0;
+    }
+    if (v >= 1.0f) {
+        return 255;
+    }
+    return static_cast<uint32_t>(std::lround(v * 255.0f));
+}
+
+inline uint32_t PremultipliedPixel(const ColorF& color, float opacity) {
+    float a = color.a * opacity;
+    return PackBgra(ToUnorm8(color.b * a), ToUnorm8(color.g * a), ToUnorm8(color.r * a), ToUnorm8(a));
+}
+
+// Exact round(x / 255) for x in [0, 255 * 255].
+inline uint32_t Div255(uint32_t x) {
+    x += 128;
+    return (x + (x >> 8)) >> 8;
+}
+
+// Premultiplied source-over for one pixel, the scalar reference every blend path is held to.
+inline uint32_t BlendOver(uint32_t src, uint32_t dst) {
+    uint32_t inv = 255 - (src >> 24);
+    if (inv == 0) {
+        return src;
+    }
+    uint32_t out = 0;
+    for (int shift = 0; shift < 32; shift += 8) {
+        uint32_t s = (src >> shift) & 0xFF;
+        uint32_t d = (dst >> shift) & 0xFF;
+        out |= (s + Div255(d * inv)) << shift;
+    }
+    return out;
+}
+
+// Multiplies every channel of a premultiplied pixel by scale/255.
+inline uint32_t ScalePixel(uint32_t px, uint32_t scale) {
+    uint32_t out = 0;
+    for (int shift = 0; shift < 32; shift += 8) {
+        out |= Div255(((px >> shift) & 0xFF) * scale) << shift;
+    }
+    return out;
+}
+
+} // namespace eb
@@ -0,0 +1,28 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace eb {
+
+// Coverage mask for one glyph, positioned relative to the pen (left edge, top of the line box).
+struct GlyphBitmap {
+    int width = 0;
+    int height = 0;
+    float advance = 0.0f;
+    std::vector<uint8_t> coverage;
+};
+
+// A 5x7 cell font built into the binary, used by the headless renderer where no system font
+// rasterizer exists. Cells are scaled to the requested pixel size and anti-aliased by exact
+// area coverage. Code points outside printable ASCII render as a hollow box; East Asian wide
+// characters get a full-em advance.
+void RasterizeBuiltinGlyph(char32_t cp, float size_px, bool bold, GlyphBitmap* out);
+float BuiltinGlyphAdvance(char32_t cp, float size_px);
+float BuiltinLineHeight(float size_px);
+
+// Decodes the next code point from UTF-16 (Windows) or UTF-32 wchar_t text.
+char32_t NextCodePoint(const wchar_t* text, size_t size, size_t* index);
+
+} // namespace eb
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <string>
+
+namespace eb {
+
+enum class VisualMode { Breathing, Image, ImageBreathing };
+enum class ImageMode { Fit, Fill, Center };
+enum class Language { English, Chinese };
+
+// Layout-compatible with D2D1_COLOR_F so the Win32 side can convert without copying fields by name.
+struct ColorF {
+    float r = 0.0f;
+    float g = 0.0f;
+    float b = 0.0f;
+    float a = 1.0f;
+};
+
+struct Config {
+    Language language = Language::English;
+    bool autostart = false;
+    double work_interval_minutes = 20.0;
+    double rest_seconds = 20.0;
+    double fade_ms = 600.0;
+    double fps = 20.0;
+
+    ColorF bg_color{0x11 / 255.0f, 0x11 / 255.0f, 0x11 / 255.0f, 1.0f};
+    ColorF text_color{0xCF / 255.0f, 0xCF / 255.0f, 0xCF / 255.0f, 1.0f};
+    std::wstring message = L"Look far and blink";
+
+    VisualMode visual_mode = VisualMode::Image;
+    std::wstring image_path = L"assets\\bg.png";
+    ImageMode image_mode = ImageMode::Fit;
+    float image_opacity = 0.35f;
+
+    double breath_cycle_ms = 9000.0;
+    float breath_min_radius = 80.0f;
+    float breath_max_radius = 140.0f;
+    float breath_opacity = 0.35f;
+};
+
+} // namespace eb
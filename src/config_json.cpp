@@ -0,0 +1,552 @@
+#include "config_json.h"
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <cstdint>
+#include <system_error>
+
+namespace eb {
+namespace {
+
+bool IsJsonSpace(char c) {
+    return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+}
+
+bool IsDigit(char c) {
+    return c >= '0' && c <= '9';
+}
+
+int HexValue(char c) {
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'a' && c <= 'f') return 10 + (c - 'a');
+    if (c >= 'A' && c <= 'F') return 10 + (c - 'A');
+    return -1;
+}
+
+void AppendUtf8(std::string* out, uint32_t cp) {
+    if (cp < 0x80) {
+        out->push_back(static_cast<char>(cp));
+    } else if (cp < 0x800) {
+        out->push_back(static_cast<char>(0xC0 | (cp >> 6)));
+        out->push_back(static_cast<char>(0x80 | (cp & 0x3F)));
+    } else if (cp < 0x10000) {
+        out->push_back(static_cast<char>(0xE0 | (cp >> 12)));
+        out->push_back(static_cast<char>(0x80 | ((cp >> 6) & 0x3F)));
+        out->push_back(static_cast<char>(0x80 | (cp & 0x3F)));
+    } else {
+        out->push_back(static_cast<char>(0xF0 | (cp >> 18)));
+        out->push_back(static_cast<char>(0x80 | ((cp >> 12) & 0x3F)));
+        out->push_back(static_cast<char>(0x80 | ((cp >> 6) & 0x3F)));
+        out->push_back(static_cast<char>(0x80 | (cp & 0x3F)));
+    }
+}
+
+void AppendWide(std::wstring* out, uint32_t cp) {
+    if constexpr (sizeof(wchar_t) == 2) {
+        if (cp >= 0x10000) {
+            cp -= 0x10000;
+            out->push_back(static_cast<wchar_t>(0xD800 + (cp >> 10)));
+            out->push_back(static_cast<wchar_t>(0xDC00 + (cp & 0x3FF)));
+            return;
+        }
+    }
+    out->push_back(static_cast<wchar_t>(cp));
+}
+
+// Malformed sequences decode to U+FFFD, matching what MultiByteToWideChar does without MB_ERR_INVALID_CHARS.
+std::wstring Utf8ToWideString(std::string_view text) {
+    std::wstring out;
+    out.reserve(text.size());
+    size_t i = 0;
+    while (i < text.size()) {
+        unsigned char c = static_cast<unsigned char>(text[i]);
+        if (c < 0x80) {
+            out.push_back(static_cast<wchar_t>(c));
+            ++i;
+            continue;
+        }
+        int extra = 0;
+        uint32_t cp = 0;
+        uint32_t min_cp = 0;
+        if ((c & 0xE0) == 0xC0) {
+            extra = 1;
+            cp = c & 0x1F;
+            min_cp = 0x80;
+        } else if ((c & 0xF0) == 0xE0) {
+            extra = 2;
+            cp = c & 0x0F;
+            min_cp = 0x800;
+        } else if ((c & 0xF8) == 0xF0) {
+            extra = 3;
+            cp = c & 0x07;
+            min_cp = 0x10000;
+        } else {
+            AppendWide(&out, 0xFFFD);
+            ++i;
+            continue;
+        }
+        size_t j = i + 1;
+        bool ok = true;
+        for (int k = 0; k < extra; ++k, ++j) {
+            if (j >= text.size() || (static_cast<unsigned char>(text[j]) & 0xC0) != 0x80) {
+                ok = false;
+                break;
+            }
+            cp = (cp << 6) | (static_cast<unsigned char>(text[j]) & 0x3F);
+        }
+        if (!ok || cp < min_cp || cp > 0x10FFFF || (cp >= 0xD800 && cp <= 0xDFFF)) {
+            AppendWide(&out, 0xFFFD);
+            i = ok ? j : std::max(j, i + 1);
+            continue;
+        }
+        AppendWide(&out, cp);
+        i = j;
+    }
+    return out;
+}
+
+enum class FieldKind { String, Number, Bool };
+
+struct ConfigField {
+    std::string_view key;
+    FieldKind kind;
+    void (*apply)(Config& cfg, const JsonToken& value);
+};
+
+bool ReadBool(const JsonToken& value, bool* out) {
+    if (value.type == JsonTokenType::True || value.type == JsonTokenType::False) {
+        *out = value.type == JsonTokenType::True;
+        return true;
+    }
+    // Older hand-written configs used 1/0 for flags.
+    if (value.type == JsonTokenType::Number && (value.number == 0.0 || value.number == 1.0)) {
+        *out = value.number == 1.0;
+        return true;
+    }
+    return false;
+}
+
+// Must stay sorted by key; checked at compile time below.
+constexpr std::array<ConfigField, 17> kConfigFields = {{
+    {"autostart", FieldKind::Bool, [](Config& cfg, const JsonToken& v) { ReadBool(v, &cfg.autostart); }},
+    {"bg_color", FieldKind::String, [](Config& cfg, const JsonToken& v) { ParseHexColor(v.text, &cfg.bg_color); }},
+    {"breath_cycle_ms", FieldKind::Number, [](Config& cfg, const JsonToken& v) { cfg.breath_cycle_ms = v.number; }},
+    {"breath_max_radius", FieldKind::Number, [](Config& cfg, const JsonToken& v) { cfg.breath_max_radius = static_cast<float>(v.number); }},
+    {"breath_min_radius", FieldKind::Number, [](Config& cfg, const JsonToken& v) { cfg.breath_min_radius = static_cast<float>(v.number); }},
+    {"breath_opacity", FieldKind::Number, [](Config& cfg, const JsonToken& v) { cfg.breath_opacity = static_cast<float>(v.number); }},
+    {"fade_ms", FieldKind::Number, [](Config& cfg, const JsonToken& v) { cfg.fade_ms = v.number; }},
+    {"fps", FieldKind::Number, [](Config& cfg, const JsonToken& v) { cfg.fps = v.number; }},
+    {"image_mode", FieldKind::String, [](Config& cfg, const JsonToken& v) {
+        std::string mode = ToLowerAscii(v.text);
+        if (mode == "fill") {
+            cfg.image_mode = ImageMode::Fill;
+        } else if (mode == "center") {
+            cfg.image_mode = ImageMode::Center;
+        } else {
+            cfg.image_mode = ImageMode::Fit;
+        }
+    }},
+    {"image_opacity", FieldKind::Number, [](Config& cfg, const JsonToken& v) { cfg.image_opacity = static_cast<float>(v.number); }},
+    {"image_path", FieldKind::String, [](Config& cfg, const JsonToken& v) { cfg.image_path = Utf8ToWideString(v.text); }},
+    {"language", FieldKind::String, [](Config& cfg, const JsonToken& v) { cfg.language = ParseLanguage(v.text); }},
+    {"message", FieldKind::String, [](Config& cfg, const JsonToken& v) { cfg.message = Utf8ToWideString(v.text); }},
+    {"rest_seconds", FieldKind::Number, [](Config& cfg, const JsonToken& v) { cfg.rest_seconds = v.number; }},
+    {"text_color", FieldKind::String, [](Config& cfg, const JsonToken& v) { ParseHexColor(v.text, &cfg.text_color); }},
+    {"visual_mode", FieldKind::String, [](Config& cfg, const JsonToken& v) {
+        std::string mode = ToLowerAscii(v.text);
+        if (mode == "image") {
+            cfg.visual_mode = VisualMode::Image;
+        } else if (mode == "image+breathing") {
+            cfg.visual_mode = VisualMode::ImageBreathing;
+        } else {
+            cfg.visual_mode = VisualMode::Breathing;
+        }
+    }},
+    {"work_interval_minutes", FieldKind::Number, [](Config& cfg, const JsonToken& v) { cfg.work_interval_minutes = v.number; }},
+}};
+
+static_assert(std::is_sorted(kConfigFields.begin(), kConfigFields.end(),
+    [](const ConfigField& a, const ConfigField& b) { return a.key < b.key; }));
+
+const ConfigField* FindConfigField(std::string_view key) {
+    auto it = std::lower_bound(kConfigFields.begin(), kConfigFields.end(), key,
+        [](const ConfigField& field, std::string_view k) { return field.key < k; });
+    if (it == kConfigFields.end() || it->key != key) {
+        return nullptr;
+    }
+    return &*it;
+}
+
+bool KindMatches(FieldKind kind, JsonTokenType type) {
+    switch (kind) {
+        case FieldKind::String:
+            return type == JsonTokenType::String;
+        case FieldKind::Number:
+            return type == JsonTokenType::Number;
+        case FieldKind::Bool:
+            return type == JsonTokenType::True || type == JsonTokenType::False || type == JsonTokenType::Number;
+    }
+    return false;
+}
+
+bool ParseFail(size_t offset, const char* message, JsonError* error) {
+    if (error) {
+        error->offset = offset;
+        error->message = message;
+    }
+    return false;
+}
+
+// Consumes the rest of an object or array whose opening token has already been read.
+bool SkipContainer(JsonTokenizer* tokenizer, JsonError* error) {
+    int depth = 1;
+    JsonToken token;
+    while (depth > 0) {
+        if (!tokenizer->Next(&token, error)) {
+            return false;
+        }
+        switch (token.type) {
+            case JsonTokenType::BeginObject:
+            case JsonTokenType::BeginArray:
+                ++depth;
+                break;
+            case JsonTokenType::EndObject:
+            case JsonTokenType::EndArray:
+                --depth;
+                break;
+            case JsonTokenType::End:
+                return ParseFail(token.offset, "unterminated object or array", error);
+            default:
+                break;
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+JsonTokenizer::JsonTokenizer(std::string_view input) : input_(input) {}
+
+bool JsonTokenizer::Fail(size_t offset, const char* message, JsonError* error) {
+    return ParseFail(offset, message, error);
+}
+
+bool JsonTokenizer::Next(JsonToken* token, JsonError* error) {
+    while (pos_ < input_.size() && IsJsonSpace(input_[pos_])) {
+        ++pos_;
+    }
+    token->offset = pos_;
+    token->text = {};
+    if (pos_ >= input_.size()) {
+        token->type = JsonTokenType::End;
+        return true;
+    }
+    char c = input_[pos_];
+    switch (c) {
+        case '{':
+            token->type = JsonTokenType::BeginObject;
+            ++pos_;
+            return true;
+        case '}':
+            token->type = JsonTokenType::EndObject;
+            ++pos_;
+            return true;
+        case '[':
+            token->type = JsonTokenType::BeginArray;
+            ++pos_;
+            return true;
+        case ']':
+            token->type = JsonTokenType::EndArray;
+            ++pos_;
+            return true;
+        case ':':
+            token->type = JsonTokenType::Colon;
+            ++pos_;
+            return true;
+        case ',':
+            token->type = JsonTokenType::Comma;
+            ++pos_;
+            return true;
+        case '"':
+            return LexString(token, error);
+        case 't':
+            return LexLiteral("true", JsonTokenType::True, token, error);
+        case 'f':
+            return LexLiteral("false", JsonTokenType::False, token, error);
+        case 'n':
+            return LexLiteral("null", JsonTokenType::Null, token, error);
+        default:
+            if (c == '-' || IsDigit(c)) {
+                return LexNumber(token, error);
+            }
+            return Fail(pos_, "unexpected character", error);
+    }
+}
+
+bool JsonTokenizer::LexLiteral(std::string_view word, JsonTokenType type, JsonToken* token, JsonError* error) {
+    if (input_.compare(pos_, word.size(), word) != 0) {
+        return Fail(pos_, "invalid literal", error);
+    }
+    token->type = type;
+    pos_ += word.size();
+    return true;
+}
+
+bool JsonTokenizer::LexNumber(JsonToken* token, JsonError* error) {
+    size_t start = pos_;
+    size_t i = pos_;
+    if (input_[i] == '-') {
+        ++i;
+    }
+    if (i >= input_.size() || !IsDigit(input_[i])) {
+        return Fail(i, "expected digit", error);
+    }
+    if (input_[i] == '0') {
+        ++i;
+    } else {
+        while (i < input_.size() && IsDigit(input_[i])) {
+            ++i;
+        }
+    }
+    if (i < input_.size() && input_[i] == '.') {
+        ++i;
+        if (i >= input_.size() || !IsDigit(input_[i])) {
+            return Fail(i, "expected digit after decimal point", error);
+        }
+        while (i < input_.size() && IsDigit(input_[i])) {
+            ++i;
+        }
+    }
+    if (i < input_.size() && (input_[i] == 'e' || input_[i] == 'E')) {
+        ++i;
+        if (i < input_.size() && (input_[i] == '+' || input_[i] == '-')) {
+            ++i;
+        }
+        if (i >= input_.size() || !IsDigit(input_[i])) {
+            return Fail(i, "expected digit in exponent", error);
+        }
+        while (i < input_.size() && IsDigit(input_[i])) {
+            ++i;
+        }
+    }
+    double value = 0.0;
+    auto result = std::from_chars(input_.data() + start, input_.data() + i, value);
+    if (result.ec != std::errc()) {
+        return Fail(start, "number out of range", error);
+    }
+    token->type = JsonTokenType::Number;
+    token->number = value;
+    pos_ = i;
+    return true;
+}
+
+bool JsonTokenizer::LexString(JsonToken* token, JsonError* error) {
+    size_t start = pos_ + 1;
+    size_t i = start;
+    // Fast path: most config strings contain no escapes and can be returned as a view.
+    while (i < input_.size()) {
+        unsigned char c = static_cast<unsigned char>(input_[i]);
+        if (c == '"' || c == '\\' || c < 0x20) {
+            break;
+        }
+        ++i;
+    }
+    if (i >= input_.size()) {
+        return Fail(pos_, "unterminated string", error);
+    }
+    if (input_[i] == '"') {
+        token->type = JsonTokenType::String;
+        token->text = input_.substr(start, i - start);
+        pos_ = i + 1;
+        return true;
+    }
+
+    scratch_.assign(input_.data() + start, i - start);
+    while (i < input_.size()) {
+        unsigned char c = static_cast<unsigned char>(input_[i]);
+        if (c == '"') {
+            token->type = JsonTokenType::String;
+            token->text = scratch_;
+            pos_ = i + 1;
+            return true;
+        }
+        if (c < 0x20) {
+            return Fail(i, "control character in string", error);
+        }
+        if (c != '\\') {
+            scratch_.push_back(static_cast<char>(c));
+            ++i;
+            continue;
+        }
+        if (i + 1 >= input_.size()) {
+            break;
+        }
+        char esc = input_[i + 1];
+        switch (esc) {
+            case '"': scratch_.push_back('"'); break;
+            case '\\': scratch_.push_back('\\'); break;
+            case '/': scratch_.push_back('/'); break;
+            case 'b': scratch_.push_back('\b'); break;
+            case 'f': scratch_.push_back('\f'); break;
+            case 'n': scratch_.push_back('\n'); break;
+            case 'r': scratch_.push_back('\r'); break;
+            case 't': scratch_.push_back('\t'); break;
+            case 'u': {
+                auto read_hex4 = [&](size_t at, uint32_t* out) {
+                    if (at + 4 > input_.size()) {
+                        return false;
+                    }
+                    uint32_t v = 0;
+                    for (size_t k = 0; k < 4; ++k) {
+                        int h = HexValue(input_[at + k]);
+                        if (h < 0) {
+                            return false;
+                        }
+                        v = (v << 4) | static_cast<uint32_t>(h);
+                    }
+                    *out = v;
+                    return true;
+                };
+                uint32_t cp = 0;
+                if (!read_hex4(i + 2, &cp)) {
+                    return Fail(i, "invalid \\u escape", error);
+                }
+                if (cp >= 0xDC00 && cp <= 0xDFFF) {
+                    return Fail(i, "unpaired low surrogate", error);
+                }
+                if (cp >= 0xD800 && cp <= 0xDBFF) {
+                    uint32_t low = 0;
+                    if (i + 12 > input_.size() || input_[i + 6] != '\\' || input_[i + 7] != 'u' ||
+                        !read_hex4(i + 8, &low) || low < 0xDC00 || low > 0xDFFF) {
+                        return Fail(i, "unpaired high surrogate", error);
+                    }
+                    cp = 0x10000 + ((cp - 0xD800) << 10) + (low - 0xDC00);
+                    i += 6;
+                }
+                AppendUtf8(&scratch_, cp);
+                i += 6;
+                continue;
+            }
+            default:
+                return Fail(i, "invalid escape sequence", error);
+        }
+        i += 2;
+    }
+    return Fail(pos_, "unterminated string", error);
+}
+
+bool ParseConfigJson(std::string_view json, Config* cfg, JsonError* error) {
+    JsonTokenizer tokenizer(json);
+    JsonToken token;
+    if (!tokenizer.Next(&token, error)) {
+        return false;
+    }
+    if (token.type != JsonTokenType::BeginObject) {
+        return ParseFail(token.offset, "expected '{'", error);
+    }
+
+    bool first = true;
+    while (true) {
+        if (!tokenizer.Next(&token, error)) {
+            return false;
+        }
+        if (first && token.type == JsonTokenType::EndObject) {
+            break;
+        }
+        first = false;
+        if (token.type != JsonTokenType::String) {
+            return ParseFail(token.offset, "expected object key", error);
+        }
+        // Resolve the key before the next token can reuse the tokenizer's scratch buffer.
+        const ConfigField* field = FindConfigField(token.text);
+
+        if (!tokenizer.Next(&token, error)) {
+            return false;
+        }
+        if (token.type != JsonTokenType::Colon) {
+            return ParseFail(token.offset, "expected ':'", error);
+        }
+
+        if (!tokenizer.Next(&token, error)) {
+            return false;
+        }
+        switch (token.type) {
+            case JsonTokenType::BeginObject:
+            case JsonTokenType::BeginArray:
+                if (!SkipContainer(&tokenizer, error)) {
+                    return false;
+                }
+                break;
+            case JsonTokenType::String:
+            case JsonTokenType::Number:
+            case JsonTokenType::True:
+            case JsonTokenType::False:
+            case JsonTokenType::Null:
+                if (field && KindMatches(field->kind, token.type)) {
+                    field->apply(*cfg, token);
+                }
+                break;
+            default:
+                return ParseFail(token.offset, "expected value", error);
+        }
+
+        if (!tokenizer.Next(&token, error)) {
+            return false;
+        }
+        if (token.type == JsonTokenType::EndObject) {
+            break;
+        }
+        if (token.type != JsonTokenType::Comma) {
+            return ParseFail(token.offset, "expected ',' or '}'", error);
+        }
+    }
+
+    if (!tokenizer.Next(&token, error)) {
+        return false;
+    }
+    if (token.type != JsonTokenType::End) {
+        return ParseFail(token.offset, "unexpected data after object", error);
+    }
+    return true;
+}
+
+bool ParseHexColor(std::string_view text, ColorF* color) {
+    if (text.size() != 7 || text[0] != '#') {
+        return false;
+    }
+    int r1 = HexValue(text[1]);
+    int r2 = HexValue(text[2]);
+    int g1 = HexValue(text[3]);
+    int g2 = HexValue(text[4]);
+    int b1 = HexValue(text[5]);
+    int b2 = HexValue(text[6]);
+    if (r1 < 0 || r2 < 0 || g1 < 0 || g2 < 0 || b1 < 0 || b2 < 0) {
+        return false;
+    }
+    int r = r1 * 16 + r2;
+    int g = g1 * 16 + g2;
+    int b = b1 * 16 + b2;
+    *color = ColorF{r / 255.0f, g / 255.0f, b / 255.0f, 1.0f};
+    return true;
+}
+
+std::string ToLowerAscii(std::string_view value) {
+    std::string out(value);
+    for (char& c : out) {
+        if (c >= 'A' && c <= 'Z') {
+            c = static_cast<char>(c - 'A' + 'a');
+        }
+    }
+    return out;
+}
+
+Language ParseLanguage(std::string_view value) {
+    std::string v = ToLowerAscii(value);
+    if (v == "zh" || v == "zh-cn" || v == "cn" || v == "chinese") {
+        return Language::Chinese;
+    }
+    return Language::English;
+}
+
+} // namespace eb
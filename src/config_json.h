@@ -0,0 +1,70 @@
+#pragma once
+
+#include "config.h"
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+namespace eb {
+
+struct JsonError {
+    size_t offset = 0;
+    std::string message;
+};
+
+enum class JsonTokenType {
+    BeginObject,
+    EndObject,
+    BeginArray,
+    EndArray,
+    Colon,
+    Comma,
+    String,
+    Number,
+    True,
+    False,
+    Null,
+    End,
+};
+
+struct JsonToken {
+    JsonTokenType type = JsonTokenType::End;
+    size_t offset = 0;
+    // Decoded UTF-8 for String tokens. Points into the tokenizer's scratch buffer when the
+    // string contained escapes, otherwise straight into the input; valid until the next call.
+    std::string_view text;
+    double number = 0.0;
+};
+
+// Single-pass JSON tokenizer. Every byte of the input is visited once; string escapes
+// (including \uXXXX surrogate pairs) are decoded to UTF-8 and numbers follow the JSON grammar.
+class JsonTokenizer {
+public:
+    explicit JsonTokenizer(std::string_view input);
+
+    bool Next(JsonToken* token, JsonError* error);
+    size_t offset() const { return pos_; }
+
+private:
+    bool LexString(JsonToken* token, JsonError* error);
+    bool LexNumber(JsonToken* token, JsonError* error);
+    bool LexLiteral(std::string_view word, JsonTokenType type, JsonToken* token, JsonError* error);
+    bool Fail(size_t offset, const char* message, JsonError* error);
+
+    std::string_view input_;
+    size_t pos_ = 0;
+    std::string scratch_;
+};
+
+// Walks the document once and routes every top-level key to its Config field through a
+// sorted lookup table. Unknown keys and values of the wrong type are skipped. Fields seen
+// before a syntax error are kept, so a damaged file still yields as much of the user's
+// configuration as possible. Paths are not resolved and values are not clamped here.
+bool ParseConfigJson(std::string_view json, Config* cfg, JsonError* error);
+
+bool ParseHexColor(std::string_view text, ColorF* color);
+Language ParseLanguage(std::string_view value);
+std::string ToLowerAscii(std::string_view value);
+
+} // namespace eb
@@ -5,6 +5,10 @@
 #include <wincodec.h>
 #include <shellapi.h>
 #include "resource.h"
+#include "config.h"
+#include "config_json.h"
+#include "overlay_frame.h"
+#include "render_backend.h"
 
 #include <algorithm>
 #include <cctype>
@@ -31,7 +35,6 @@ constexpr double kMinFadeSeconds = 0.05;
 constexpr double kMinRestSeconds = 1.0;
 constexpr double kMinFps = 5.0;
 constexpr double kMaxFps = 60.0;
-constexpr double kPi = 3.141592653589793;
 
 constexpr UINT kCmdShowOverlay = 1001;
 constexpr UINT kCmdOpenSettings = 1002;
@@ -49,32 +52,10 @@ constexpr UINT kSettingsReloadId = 2002;
 #define NIF_SHOWTIP 0x00000080
 #endif
 
-enum class VisualMode { Breathing, Image, ImageBreathing };
-enum class ImageMode { Fit, Fill, Center };
-enum class Language { English, Chinese };
-
-struct Config {
-    Language language = Language::English;
-    bool autostart = false;
-    double work_interval_minutes = 20.0;
-    double rest_seconds = 20.0;
-    double fade_ms = 600.0;
-    double fps = 20.0;
-
-    D2D1_COLOR_F bg_color = D2D1::ColorF(0x11 / 255.0f, 0x11 / 255.0f, 0x11 / 255.0f, 1.0f);
-    D2D1_COLOR_F text_color = D2D1::ColorF(0xCF / 255.0f, 0xCF / 255.0f, 0xCF / 255.0f, 1.0f);
-    std::wstring message = L"Look far and blink";
-
-    VisualMode visual_mode = VisualMode::Image;
-    std::wstring image_path = L"assets\\bg.png";
-    ImageMode image_mode = ImageMode::Fit;
-    float image_opacity = 0.35f;
-
-    double breath_cycle_ms = 9000.0;
-    float breath_min_radius = 80.0f;
-    float breath_max_radius = 140.0f;
-    float breath_opacity = 0.35f;
-};
+using eb::Config;
+using eb::ImageMode;
+using eb::Language;
+using eb::VisualMode;
 
 struct AppState {
     enum class Phase { FadeIn, Rest, FadeOut };
@@ -109,7 +90,6 @@ ULONGLONG g_next_overlay_tick = 0;
 
 ID2D1Factory* g_d2d_factory = nullptr;
 ID2D1HwndRenderTarget* g_render_target = nullptr;
-ID2D1SolidColorBrush* g_bg_brush = nullptr;
 ID2D1SolidColorBrush* g_text_brush = nullptr;
 ID2D1SolidColorBrush* g_breath_brush = nullptr;
 IDWriteFactory* g_dwrite_factory = nullptr;
@@ -264,104 +244,6 @@ bool WriteFileUtf8(const std::wstring& path, const std::string& data) {
     file.write(data.data(), static_cast<std::streamsize>(data.size()));
     return file.good();
 }
-bool FindValueStart(const std::string& json, const char* key, size_t* pos_out) {
-    std::string needle = "\"";
-    needle += key;
-    needle += "\"";
-    size_t pos = json.find(needle);
-    if (pos == std::string::npos) {
-        return false;
-    }
-    pos = json.find(':', pos + needle.size());
-    if (pos == std::string::npos) {
-        return false;
-    }
-    pos += 1;
-    while (pos < json.size() && std::isspace(static_cast<unsigned char>(json[pos]))) {
-        ++pos;
-    }
-    if (pos >= json.size()) {
-        return false;
-    }
-    *pos_out = pos;
-    return true;
-}
-
-bool ExtractString(const std::string& json, const char* key, std::string* out) {
-    size_t pos = 0;
-    if (!FindValueStart(json, key, &pos)) {
-        return false;
-    }
-    if (json[pos] != '"') {
-        return false;
-    }
-    std::string value;
-    for (size_t i = pos + 1; i < json.size(); ++i) {
-        char c = json[i];
-        if (c == '\\' && i + 1 < json.size()) {
-            value.push_back(json[i + 1]);
-            ++i;
-            continue;
-        }
-        if (c == '"') {
-            *out = value;
-            return true;
-        }
-        value.push_back(c);
-    }
-    return false;
-}
-
-bool ExtractDouble(const std::string& json, const char* key, double* out) {
-    size_t pos = 0;
-    if (!FindValueStart(json, key, &pos)) {
-        return false;
-    }
-    char* end = nullptr;
-    double value = std::strtod(json.c_str() + pos, &end);
-    if (end == json.c_str() + pos) {
-        return false;
-    }
-    *out = value;
-    return true;
-}
-
-bool ExtractBool(const std::string& json, const char* key, bool* out) {
-    size_t pos = 0;
-    if (!FindValueStart(json, key, &pos)) {
-        return false;
-    }
-    if (json.compare(pos, 4, "true") == 0) {
-        *out = true;
-        return true;
-    }
-    if (json.compare(pos, 5, "false") == 0) {
-        *out = false;
-        return true;
-    }
-    if (json[pos] == '1' || json[pos] == '0') {
-        *out = (json[pos] == '1');
-        return true;
-    }
-    return false;
-}
-
-std::string ToLowerAscii(std::string value) {
-    for (char& c : value) {
-        if (c >= 'A' && c <= 'Z') {
-            c = static_cast<char>(c - 'A' + 'a');
-        }
-    }
-    return value;
-}
-
-Language ParseLanguage(const std::string& value) {
-    std::string v = ToLowerAscii(value);
-    if (v == "zh" || v == "zh-cn" || v == "cn" || v == "chinese") {
-        return Language::Chinese;
-    }
-    return Language::English;
-}
 
 std::string Trim(const std::string& value) {
     size_t start = 0;
@@ -504,30 +386,8 @@ void UpdateTrayTooltip() {
     Shell_NotifyIcon(NIM_MODIFY, &nid);
 }
 
-bool ParseHexColor(const std::string& text, D2D1_COLOR_F* color) {
-    if (text.size() != 7 || text[0] != '#') {
-        return false;
-    }
-    auto hex_to_int = [](char c) -> int {
-        if (c >= '0' && c <= '9') return c - '0';
-        if (c >= 'a' && c <= 'f') return 10 + (c - 'a');
-        if (c >= 'A' && c <= 'F') return 10 + (c - 'A');
-        return -1;
-    };
-    int r1 = hex_to_int(text[1]);
-    int r2 = hex_to_int(text[2]);
-    int g1 = hex_to_int(text[3]);
-    int g2 = hex_to_int(text[4]);
-    int b1 = hex_to_int(text[5]);
-    int b2 = hex_to_int(text[6]);
-    if (r1 < 0 || r2 < 0 || g1 < 0 || g2 < 0 || b1 < 0 || b2 < 0) {
-        return false;
-    }
-    int r = r1 * 16 + r2;
-    int g = g1 * 16 + g2;
-    int b = b1 * 16 + b2;
-    *color = D2D1::ColorF(r / 255.0f, g / 255.0f, b / 255.0f, 1.0f);
-    return true;
+D2D1_COLOR_F ToD2DColor(const eb::ColorF& color) {
+    return D2D1::ColorF(color.r, color.g, color.b, color.a);
 }
 
 std::string EscapeJsonString(const std::string& value) {
@@ -612,81 +472,11 @@ void LoadConfig() {
         json = ReadFileUtf8(config_path);
     }
     if (!json.empty()) {
-        double value = 0.0;
-        bool flag = false;
-        std::string lang;
-        if (ExtractString(json, "language", &lang)) {
-            cfg.language = ParseLanguage(lang);
-        }
-        if (ExtractBool(json, "autostart", &flag)) {
-            cfg.autostart = flag;
-        }
-        if (ExtractDouble(json, "work_interval_minutes", &value)) {
-            cfg.work_interval_minutes = value;
-        }
-        if (ExtractDouble(json, "rest_seconds", &value)) {
-            cfg.rest_seconds = value;
-        }
-        if (ExtractDouble(json, "fade_ms", &value)) {
-            cfg.fade_ms = value;
-        }
-        if (ExtractDouble(json, "fps", &value)) {
-            cfg.fps = value;
-        }
-
-        std::string str;
-        if (ExtractString(json, "message", &str)) {
-            cfg.message = Utf8ToWide(str);
-        }
-        if (ExtractString(json, "bg_color", &str)) {
-            D2D1_COLOR_F color{};
-            if (ParseHexColor(str, &color)) {
-                cfg.bg_color = color;
-            }
-        }
-        if (ExtractString(json, "text_color", &str)) {
-            D2D1_COLOR_F color{};
-            if (ParseHexColor(str, &color)) {
-                cfg.text_color = color;
-            }
-        }
-        if (ExtractString(json, "visual_mode", &str)) {
-            std::string mode = ToLowerAscii(str);
-            if (mode == "image") {
-                cfg.visual_mode = VisualMode::Image;
-            } else if (mode == "image+breathing") {
-                cfg.visual_mode = VisualMode::ImageBreathing;
-            } else {
-                cfg.visual_mode = VisualMode::Breathing;
-            }
-        }
-        if (ExtractString(json, "image_path", &str)) {
-            cfg.image_path = Utf8ToWide(str);
-        }
-        if (ExtractString(json, "image_mode", &str)) {
-            std::string mode = ToLowerAscii(str);
-            if (mode == "fill") {
-                cfg.image_mode = ImageMode::Fill;
-            } else if (mode == "center") {
-                cfg.image_mode = ImageMode::Center;
-            } else {
-                cfg.image_mode = ImageMode::Fit;
-            }
-        }
-        if (ExtractDouble(json, "image_opacity", &value)) {
-            cfg.image_opacity = static_cast<float>(value);
-        }
-        if (ExtractDouble(json, "breath_cycle_ms", &value)) {
-            cfg.breath_cycle_ms = value;
-        }
-        if (ExtractDouble(json, "breath_min_radius", &value)) {
-            cfg.breath_min_radius = static_cast<float>(value);
-        }
-        if (ExtractDouble(json, "breath_max_radius", &value)) {
-            cfg.breath_max_radius = static_cast<float>(value);
-        }
-        if (ExtractDouble(json, "breath_opacity", &value)) {
-            cfg.breath_opacity = static_cast<float>(value);
+        eb::JsonError error;
+        if (!eb::ParseConfigJson(json, &cfg, &error)) {
+            std::wstring note = L"config.json: " + Utf8ToWide(error.message) +
+                L" at byte " + std::to_wstring(error.offset) + L"\n";
+            OutputDebugStringW(note.c_str());
         }
     }
 
@@ -795,17 +585,12 @@ HRESULT CreateDeviceResources(HWND hwnd) {
         return hr;
     }
 
-    hr = g_render_target->CreateSolidColorBrush(g_config.bg_color, &g_bg_brush);
-    if (FAILED(hr)) {
-        return hr;
-    }
-
-    hr = g_render_target->CreateSolidColorBrush(g_config.text_color, &g_text_brush);
+    hr = g_render_target->CreateSolidColorBrush(ToD2DColor(g_config.text_color), &g_text_brush);
     if (FAILED(hr)) {
         return hr;
     }
 
-    hr = g_render_target->CreateSolidColorBrush(g_config.text_color, &g_breath_brush);
+    hr = g_render_target->CreateSolidColorBrush(ToD2DColor(g_config.text_color), &g_breath_brush);
     if (FAILED(hr)) {
         return hr;
     }
@@ -896,7 +681,6 @@ HRESULT CreateDeviceResources(HWND hwnd) {
 }
 
 void DiscardDeviceResources() {
-    SafeRelease(g_bg_brush);
     SafeRelease(g_text_brush);
     SafeRelease(g_breath_brush);
     SafeRelease(g_image_bitmap);
@@ -905,7 +689,6 @@ void DiscardDeviceResources() {
     SafeRelease(g_countdown_format);
     SafeRelease(g_dwrite_factory);
     SafeRelease(g_d2d_factory);
-    g_bg_brush = nullptr;
     g_text_brush = nullptr;
     g_breath_brush = nullptr;
     g_image_bitmap = nullptr;
@@ -931,74 +714,65 @@ void ApplyConfig(HWND hwnd) {
     UpdateLocalizedWindowTexts();
 }
 
-void Render(HWND hwnd) {
-    if (!g_overlay_visible) {
-        return;
-    }
-    if (FAILED(CreateDeviceResources(hwnd))) {
-        return;
-    }
-
-    g_render_target->BeginDraw();
-    g_render_target->Clear(g_config.bg_color);
+D2D1_RECT_F ToD2DRect(const eb::RectF& rect) {
+    return D2D1::RectF(rect.left, rect.top, rect.right, rect.bottom);
+}
 
-    D2D1_SIZE_F size = g_render_target->GetSize();
-    float width = size.width;
-    float height = size.height;
+// Routes the shared frame description to the current Direct2D device resources.
+class D2DRenderBackend : public eb::RenderBackend {
+public:
+    eb::SizeF GetSize() const override {
+        D2D1_SIZE_F size = g_render_target->GetSize();
+        return eb::SizeF{size.width, size.height};
+    }
 
-    int seconds_left = static_cast<int>(std::ceil(g_state.rest_remaining));
-    if (seconds_left < 0) {
-        seconds_left = 0;
+    bool HasImage() const override {
+        return g_image_bitmap != nullptr;
     }
 
-    std::wstring message = g_config.message;
-    std::wstring countdown = std::to_wstring(seconds_left) + L" s";
+    eb::SizeF GetImageSize() const override {
+        return eb::SizeF{g_image_size.width, g_image_size.height};
+    }
 
-    D2D1_RECT_F message_rect = D2D1::RectF(0.0f, height * 0.4f - 40.0f, width, height * 0.4f + 20.0f);
-    D2D1_RECT_F countdown_rect = D2D1::RectF(0.0f, height * 0.5f - 20.0f, width, height * 0.5f + 120.0f);
+    void Clear(const eb::ColorF& color) override {
+        g_render_target->Clear(ToD2DColor(color));
+    }
 
-    g_render_target->FillRectangle(D2D1::RectF(0.0f, 0.0f, width, height), g_bg_brush);
+    void DrawImage(const eb::RectF& dest, float opacity) override {
+        g_render_target->DrawBitmap(g_image_bitmap, ToD2DRect(dest), opacity, D2D1_BITMAP_INTERPOLATION_MODE_LINEAR);
+    }
 
-    if (g_image_bitmap && g_config.visual_mode != VisualMode::Breathing) {
-        float img_w = g_image_size.width;
-        float img_h = g_image_size.height;
-        if (img_w > 0.0f && img_h > 0.0f) {
-            float scale = 1.0f;
-            if (g_config.image_mode == ImageMode::Fit) {
-                scale = std::min(width / img_w, height / img_h);
-            } else if (g_config.image_mode == ImageMode::Fill) {
-                scale = std::max(width / img_w, height / img_h);
-            }
-            float draw_w = img_w * scale;
-            float draw_h = img_h * scale;
-            if (g_config.image_mode == ImageMode::Center) {
-                draw_w = img_w;
-                draw_h = img_h;
-            }
-            float x = (width - draw_w) * 0.5f;
-            float y = (height - draw_h) * 0.5f;
-            D2D1_RECT_F dest = D2D1::RectF(x, y, x + draw_w, y + draw_h);
-            g_render_target->DrawBitmap(g_image_bitmap, dest, g_config.image_opacity, D2D1_BITMAP_INTERPOLATION_MODE_LINEAR);
+    void StrokeCircle(eb::PointF center, float radius, float stroke_width, const eb::ColorF& color, float opacity) override {
+        if (!g_breath_brush) {
+            return;
         }
+        g_breath_brush->SetColor(ToD2DColor(color));
+        g_breath_brush->SetOpacity(opacity);
+        D2D1_ELLIPSE ellipse = D2D1::Ellipse(D2D1::Point2F(center.x, center.y), radius, radius);
+        g_render_target->DrawEllipse(ellipse, g_breath_brush, stroke_width);
     }
 
-    if (g_config.visual_mode != VisualMode::Image) {
-        double cycle = std::max(0.1, g_config.breath_cycle_ms / 1000.0);
-        double phase = std::fmod(g_state.total_elapsed, cycle) / cycle;
-        double t = 0.5 - 0.5 * std::cos(phase * 2.0 * kPi);
-        float radius = (g_config.breath_min_radius +
-            static_cast<float>((g_config.breath_max_radius - g_config.breath_min_radius) * t)) * 1.5f;
-        float alpha = g_config.breath_opacity * static_cast<float>(0.6 + 0.4 * std::sin(phase * 2.0 * kPi));
-        alpha = std::clamp(alpha, 0.0f, 1.0f);
-        if (g_breath_brush) {
-            g_breath_brush->SetOpacity(alpha);
-            D2D1_ELLIPSE ellipse = D2D1::Ellipse(D2D1::Point2F(width * 0.5f, height * 0.45f), radius, radius);
-            g_render_target->DrawEllipse(ellipse, g_breath_brush, 3.0f);
-        }
+    void DrawTextRun(std::wstring_view text, eb::TextStyle style, const eb::RectF& layout, const eb::ColorF& color) override {
+        IDWriteTextFormat* format = style == eb::TextStyle::Countdown ? g_countdown_format : g_message_format;
+        g_text_brush->SetColor(ToD2DColor(color));
+        g_render_target->DrawTextW(text.data(), static_cast<UINT32>(text.size()), format, ToD2DRect(layout), g_text_brush);
+    }
+};
+
+void Render(HWND hwnd) {
+    if (!g_overlay_visible) {
+        return;
+    }
+    if (FAILED(CreateDeviceResources(hwnd))) {
+        return;
     }
 
-    g_render_target->DrawTextW(message.c_str(), static_cast<UINT32>(message.size()), g_message_format, message_rect, g_text_brush);
-    g_render_target->DrawTextW(countdown.c_str(), static_cast<UINT32>(countdown.size()), g_countdown_format, countdown_rect, g_text_brush);
+    g_render_target->BeginDraw();
+    D2DRenderBackend backend;
+    eb::OverlayFrameInput input;
+    input.total_elapsed = g_state.total_elapsed;
+    input.rest_remaining = g_state.rest_remaining;
+    eb::RenderOverlayFrame(&backend, g_config, input);
 
     HRESULT hr = g_render_target->EndDraw();
     if (hr == D2DERR_RECREATE_TARGET) {
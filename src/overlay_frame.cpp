@@ -0,0 +1,77 @@
+#include "overlay_frame.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace eb {
+
+RectF ComputeImageRect(ImageMode mode, SizeF target, SizeF image) {
+    float scale = 1.0f;
+    if (mode == ImageMode::Fit) {
+        scale = std::min(target.width / image.width, target.height / image.height);
+    } else if (mode == ImageMode::Fill) {
+        scale = std::max(target.width / image.width, target.height / image.height);
+    }
+    float draw_w = image.width * scale;
+    float draw_h = image.height * scale;
+    if (mode == ImageMode::Center) {
+        draw_w = image.width;
+        draw_h = image.height;
+    }
+    float x = (target.width - draw_w) * 0.5f;
+    float y = (target.height - draw_h) * 0.5f;
+    return RectF{x, y, x + draw_w, y + draw_h};
+}
+
+BreathRing ComputeBreathRing(const Config& cfg, SizeF target, double total_elapsed) {
+    double cycle = std::max(0.1, cfg.breath_cycle_ms / 1000.0);
+    double phase = std::fmod(total_elapsed, cycle) / cycle;
+    double t = 0.5 - 0.5 * std::cos(phase * 2.0 * kPi);
+    BreathRing ring;
+    ring.center = PointF{target.width * 0.5f, target.height * 0.45f};
+    ring.radius = (cfg.breath_min_radius +
+        static_cast<float>((cfg.breath_max_radius - cfg.breath_min_radius) * t)) * 1.5f;
+    float alpha = cfg.breath_opacity * static_cast<float>(0.6 + 0.4 * std::sin(phase * 2.0 * kPi));
+    ring.alpha = std::clamp(alpha, 0.0f, 1.0f);
+    return ring;
+}
+
+RectF MessageRect(SizeF target) {
+    return RectF{0.0f, target.height * 0.4f - 40.0f, target.width, target.height * 0.4f + 20.0f};
+}
+
+RectF CountdownRect(SizeF target) {
+    return RectF{0.0f, target.height * 0.5f - 20.0f, target.width, target.height * 0.5f + 120.0f};
+}
+
+int CountdownSeconds(double rest_remaining) {
+    int seconds_left = static_cast<int>(std::ceil(rest_remaining));
+    return seconds_left < 0 ? 0 : seconds_left;
+}
+
+std::wstring FormatCountdown(int seconds_left) {
+    return std::to_wstring(seconds_left) + L" s";
+}
+
+void RenderOverlayFrame(RenderBackend* backend, const Config& cfg, const OverlayFrameInput& input) {
+    SizeF size = backend->GetSize();
+    backend->Clear(cfg.bg_color);
+
+    if (backend->HasImage() && cfg.visual_mode != VisualMode::Breathing) {
+        SizeF image = backend->GetImageSize();
+        if (image.width > 0.0f && image.height > 0.0f) {
+            backend->DrawImage(ComputeImageRect(cfg.image_mode, size, image), cfg.image_opacity);
+        }
+    }
+
+    if (cfg.visual_mode != VisualMode::Image) {
+        BreathRing ring = ComputeBreathRing(cfg, size, input.total_elapsed);
+        backend->StrokeCircle(ring.center, ring.radius, kBreathStrokeWidth, cfg.text_color, ring.alpha);
+    }
+
+    std::wstring countdown = FormatCountdown(CountdownSeconds(input.rest_remaining));
+    backend->DrawTextRun(cfg.message, TextStyle::Message, MessageRect(size), cfg.text_color);
+    backend->DrawTextRun(countdown, TextStyle::Countdown, CountdownRect(size), cfg.text_color);
+}
+
+} // namespace eb
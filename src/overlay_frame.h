@@ -0,0 +1,36 @@
+#pragma once
+
+#include "config.h"
+#include "render_backend.h"
+
+#include <string>
+
+namespace eb {
+
+constexpr double kPi = 3.141592653589793;
+constexpr float kBreathStrokeWidth = 3.0f;
+constexpr float kMessageFontSize = 28.0f;
+constexpr float kCountdownFontSize = 72.0f;
+
+struct OverlayFrameInput {
+    double total_elapsed = 0.0;
+    double rest_remaining = 0.0;
+};
+
+struct BreathRing {
+    PointF center;
+    float radius = 0.0f;
+    float alpha = 0.0f;
+};
+
+RectF ComputeImageRect(ImageMode mode, SizeF target, SizeF image);
+BreathRing ComputeBreathRing(const Config& cfg, SizeF target, double total_elapsed);
+RectF MessageRect(SizeF target);
+RectF CountdownRect(SizeF target);
+int CountdownSeconds(double rest_remaining);
+std::wstring FormatCountdown(int seconds_left);
+
+// Draws one complete overlay frame: background, image, breathing ring, message and countdown.
+void RenderOverlayFrame(RenderBackend* backend, const Config& cfg, const OverlayFrameInput& input);
+
+} // namespace eb
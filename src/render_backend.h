@@ -0,0 +1,48 @@
+#pragma once
+
+#include "config.h"
+
+#include <string_view>
+
+namespace eb {
+
+struct PointF {
+    float x = 0.0f;
+    float y = 0.0f;
+};
+
+struct SizeF {
+    float width = 0.0f;
+    float height = 0.0f;
+};
+
+struct RectF {
+    float left = 0.0f;
+    float top = 0.0f;
+    float right = 0.0f;
+    float bottom = 0.0f;
+
+    float Width() const { return right - left; }
+    float Height() const { return bottom - top; }
+};
+
+enum class TextStyle { Message, Countdown };
+
+// The drawing operations an overlay frame is made of. Implemented by the Direct2D target in
+// main.cpp and by SoftwareRenderBackend, so both draw exactly the same sequence of operations.
+class RenderBackend {
+public:
+    virtual ~RenderBackend() = default;
+
+    virtual SizeF GetSize() const = 0;
+    virtual bool HasImage() const = 0;
+    virtual SizeF GetImageSize() const = 0;
+
+    virtual void Clear(const ColorF& color) = 0;
+    virtual void DrawImage(const RectF& dest, float opacity) = 0;
+    virtual void StrokeCircle(PointF center, float radius, float stroke_width, const ColorF& color, float opacity) = 0;
+    // Not called DrawText: windows.h turns that name into a macro.
+    virtual void DrawTextRun(std::wstring_view text, TextStyle style, const RectF& layout, const ColorF& color) = 0;
+};
+
+} // namespace eb
@@ -0,0 +1,222 @@
+#include "soft_renderer.h"
+
+#include "builtin_font.h"
+#include "overlay_frame.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <vector>
+
+namespace eb {
+namespace {
+
+float Overlap(float a0, float a1, float b0, float b1) {
+    return std::max(0.0f, std::min(a1, b1) - std::max(a0, b0));
+}
+
+struct SampleTap {
+    int i0 = 0;
+    int i1 = 0;
+    uint32_t w1 = 0;       // weight of i1 in 1/256
+    uint32_t coverage = 0; // fraction of the destination pixel inside the image, 0..255
+};
+
+// Linear-filter taps for destination pixels [d0, d1) of an image edge spanning [start, end).
+std::vector<SampleTap> BuildTaps(int d0, int d1, float start, float end, int src_size) {
+    std::vector<SampleTap> taps(static_cast<size_t>(d1 - d0));
+    float scale = static_cast<float>(src_size) / (end - start);
+    for (int d = d0; d < d1; ++d) {
+        float u = (static_cast<float>(d) + 0.5f - start) * scale - 0.5f;
+        u = std::clamp(u, 0.0f, static_cast<float>(src_size - 1));
+        SampleTap& tap = taps[static_cast<size_t>(d - d0)];
+        tap.i0 = static_cast<int>(u);
+        tap.i1 = std::min(tap.i0 + 1, src_size - 1);
+        tap.w1 = static_cast<uint32_t>(std::lround((u - static_cast<float>(tap.i0)) * 256.0f));
+        tap.coverage = ToUnorm8(Overlap(start, end, static_cast<float>(d), static_cast<float>(d + 1)));
+    }
+    return taps;
+}
+
+uint32_t Bilinear(uint32_t p00, uint32_t p01, uint32_t p10, uint32_t p11, uint32_t wx, uint32_t wy) {
+    uint32_t out = 0;
+    for (int shift = 0; shift < 32; shift += 8) {
+        uint32_t top = ((p00 >> shift) & 0xFF) * (256 - wx) + ((p01 >> shift) & 0xFF) * wx;
+        uint32_t bottom = ((p10 >> shift) & 0xFF) * (256 - wx) + ((p11 >> shift) & 0xFF) * wx;
+        out |= ((top * (256 - wy) + bottom * wy + 32768) >> 16) << shift;
+    }
+    return out;
+}
+
+} // namespace
+
+SoftwareRenderBackend::SoftwareRenderBackend(int width, int height) : target_(width, height) {}
+
+void SoftwareRenderBackend::SetImage(std::shared_ptr<const Bitmap> image) {
+    image_ = std::move(image);
+}
+
+SizeF SoftwareRenderBackend::GetSize() const {
+    return SizeF{static_cast<float>(target_.width), static_cast<float>(target_.height)};
+}
+
+bool SoftwareRenderBackend::HasImage() const {
+    return image_ && image_->width > 0 && image_->height > 0;
+}
+
+SizeF SoftwareRenderBackend::GetImageSize() const {
+    if (!image_) {
+        return SizeF{};
+    }
+    return SizeF{static_cast<float>(image_->width), static_cast<float>(image_->height)};
+}
+
+void SoftwareRenderBackend::Clear(const ColorF& color) {
+    std::fill(target_.pixels.begin(), target_.pixels.end(), PremultipliedPixel(color, 1.0f));
+}
+
+void SoftwareRenderBackend::DrawImage(const RectF& dest, float opacity) {
+    if (!HasImage() || dest.Width() <= 0.0f || dest.Height() <= 0.0f) {
+        return;
+    }
+    int x0 = std::max(0, static_cast<int>(std::floor(dest.left)));
+    int y0 = std::max(0, static_cast<int>(std::floor(dest.top)));
+    int x1 = std::min(target_.width, static_cast<int>(std::ceil(dest.right)));
+    int y1 = std::min(target_.height, static_cast<int>(std::ceil(dest.bottom)));
+    if (x0 >= x1 || y0 >= y1) {
+        return;
+    }
+
+    std::vector<SampleTap> cols = BuildTaps(x0, x1, dest.left, dest.right, image_->width);
+    std::vector<SampleTap> rows = BuildTaps(y0, y1, dest.top, dest.bottom, image_->height);
+    uint32_t alpha = ToUnorm8(opacity);
+
+    for (int y = y0; y < y1; ++y) {
+        const SampleTap& row = rows[static_cast<size_t>(y - y0)];
+        const uint32_t* src0 = image_->Row(row.i0);
+        const uint32_t* src1 = image_->Row(row.i1);
+        uint32_t row_scale = Div255(alpha * row.coverage);
+        uint32_t* dst = target_.Row(y);
+        for (int x = x0; x < x1; ++x) {
+            const SampleTap& col = cols[static_cast<size_t>(x - x0)];
+            uint32_t sample = Bilinear(src0[col.i0], src0[col.i1], src1[col.i0], src1[col.i1], col.w1, row.w1);
+            dst[x] = BlendOver(ScalePixel(sample, Div255(row_scale * col.coverage)), dst[x]);
+        }
+    }
+}
+
+void SoftwareRenderBackend::StrokeCircle(PointF center, float radius, float stroke_width, const ColorF& color, float opacity) {
+    uint32_t base = PremultipliedPixel(color, opacity);
+    if (base == 0) {
+        return;
+    }
+    float half = stroke_width * 0.5f;
+    float outer = radius + half + 1.0f;
+    float inner = std::max(0.0f, radius - half - 1.0f);
+    int y0 = std::max(0, static_cast<int>(std::floor(center.y - outer)));
+    int y1 = std::min(target_.height, static_cast<int>(std::ceil(center.y + outer)));
+    int bx0 = std::max(0, static_cast<int>(std::floor(center.x - outer)));
+    int bx1 = std::min(target_.width, static_cast<int>(std::ceil(center.x + outer)));
+
+    for (int y = y0; y < y1; ++y) {
+        float dy = static_cast<float>(y) + 0.5f - center.y;
+        // Pixels strictly inside the inner edge get no coverage; skip that span of the row.
+        int skip0 = bx1;
+        int skip1 = bx1;
+        if (std::fabs(dy) < inner) {
+            float span = std::sqrt(inner * inner - dy * dy);
+            skip0 = static_cast<int>(std::ceil(center.x - span));
+            skip1 = static_cast<int>(std::floor(center.x + span));
+        }
+        uint32_t* dst = target_.Row(y);
+        for (int x = bx0; x < bx1; ++x) {
+            if (x == skip0 && skip1 > skip0) {
+                x = skip1 - 1;
+                continue;
+            }
+            float dx = static_cast<float>(x) + 0.5f - center.x;
+            float dist = std::sqrt(dx * dx + dy * dy);
+            float coverage = std::clamp(half + 0.5f - std::fabs(dist - radius), 0.0f, 1.0f);
+            if (coverage <= 0.0f) {
+                continue;
+            }
+            dst[x] = BlendOver(ScalePixel(base, ToUnorm8(coverage)), dst[x]);
+        }
+    }
+}
+
+void SoftwareRenderBackend::DrawTextRun(std::wstring_view text, TextStyle style, const RectF& layout, const ColorF& color) {
+    float size_px = style == TextStyle::Countdown ? kCountdownFontSize : kMessageFontSize;
+    bool bold = style == TextStyle::Countdown;
+    uint32_t base = PremultipliedPixel(color, 1.0f);
+
+    std::vector<char32_t> code_points;
+    code_points.reserve(text.size());
+    float total = 0.0f;
+    for (size_t i = 0; i < text.size();) {
+        char32_t cp = NextCodePoint(text.data(), text.size(), &i);
+        code_points.push_back(cp);
+        total += BuiltinGlyphAdvance(cp, size_px);
+    }
+    if (code_points.empty()) {
+        return;
+    }
+    // Advances include one cell of spacing after each glyph; do not count the last one.
+    total -= size_px / 10.0f;
+
+    float pen_x = std::round(layout.left + (layout.Width() - total) * 0.5f);
+    int top = static_cast<int>(std::lround(layout.top + (layout.Height() - BuiltinLineHeight(size_px)) * 0.5f));
+    GlyphBitmap glyph;
+    for (char32_t cp : code_points) {
+        RasterizeBuiltinGlyph(cp, size_px, bold, &glyph);
+        BlendMask(glyph.coverage.data(), glyph.width, glyph.height, static_cast<int>(std::lround(pen_x)), top, base);
+        pen_x += glyph.advance;
+    }
+}
+
+void SoftwareRenderBackend::BlendMask(const uint8_t* mask, int mask_w, int mask_h, int x, int y, uint32_t color) {
+    int x0 = std::max(0, x);
+    int y0 = std::max(0, y);
+    int x1 = std::min(target_.width, x + mask_w);
+    int y1 = std::min(target_.height, y + mask_h);
+    for (int py = y0; py < y1; ++py) {
+        const uint8_t* m = mask + static_cast<size_t>(py - y) * mask_w;
+        uint32_t* dst = target_.Row(py);
+        for (int px = x0; px < x1; ++px) {
+            uint32_t coverage = m[px - x];
+            if (coverage == 0) {
+                continue;
+            }
+            uint32_t src = coverage == 255 ? color : ScalePixel(color, coverage);
+            dst[px] = BlendOver(src, dst[px]);
+        }
+    }
+}
+
+BitmapDiff CompareBitmaps(const Bitmap& a, const Bitmap& b, int tolerance) {
+    BitmapDiff diff;
+    if (a.width != b.width || a.height != b.height) {
+        diff.mismatched_pixels = std::max(a.pixels.size(), b.pixels.size());
+        diff.max_channel_delta = 255;
+        return diff;
+    }
+    for (size_t i = 0; i < a.pixels.size(); ++i) {
+        uint32_t pa = a.pixels[i];
+        uint32_t pb = b.pixels[i];
+        if (pa == pb) {
+            continue;
+        }
+        int worst = 0;
+        for (int shift = 0; shift < 32; shift += 8) {
+            int delta = std::abs(static_cast<int>((pa >> shift) & 0xFF) - static_cast<int>((pb >> shift) & 0xFF));
+            worst = std::max(worst, delta);
+        }
+        diff.max_channel_delta = std::max(diff.max_channel_delta, worst);
+        if (worst > tolerance) {
+            ++diff.mismatched_pixels;
+        }
+    }
+    return diff;
+}
+
+} // namespace eb
@@ -0,0 +1,44 @@
+#pragma once
+
+#include "bitmap.h"
+#include "render_backend.h"
+
+#include <cstddef>
+#include <memory>
+
+namespace eb {
+
+// Draws overlay frames into an in-memory premultiplied BGRA framebuffer. Needs no window,
+// GPU or system font, so frames can be rendered, timed and compared on any platform.
+class SoftwareRenderBackend : public RenderBackend {
+public:
+    SoftwareRenderBackend(int width, int height);
+
+    void SetImage(std::shared_ptr<const Bitmap> image);
+    const Bitmap& framebuffer() const { return target_; }
+
+    SizeF GetSize() const override;
+    bool HasImage() const override;
+    SizeF GetImageSize() const override;
+
+    void Clear(const ColorF& color) override;
+    void DrawImage(const RectF& dest, float opacity) override;
+    void StrokeCircle(PointF center, float radius, float stroke_width, const ColorF& color, float opacity) override;
+    void DrawTextRun(std::wstring_view text, TextStyle style, const RectF& layout, const ColorF& color) override;
+
+private:
+    void BlendMask(const uint8_t* mask, int mask_w, int mask_h, int x, int y, uint32_t color);
+
+    Bitmap target_;
+    std::shared_ptr<const Bitmap> image_;
+};
+
+struct BitmapDiff {
+    size_t mismatched_pixels = 0;
+    int max_channel_delta = 0;
+};
+
+// Pixel-by-pixel comparison; channels differing by more than tolerance count as mismatches.
+BitmapDiff CompareBitmaps(const Bitmap& a, const Bitmap& b, int tolerance);
+
+} // namespace eb